@@ -0,0 +1,38 @@
+#!/usr/bin/env bash
+####################################################################################################
+## Compile every example program for a set of representative cores and report the flash and RAM  ##
+## used. Requires "arduino-cli" and "jq" with the cores listed in FQBNS already installed.        ##
+##                                                                                                ##
+## Usage: ci/footprint.sh [library directory] [output file]                                       ##
+##                                                                                                ##
+## Each output line has the form "<fqbn> <example> <flash bytes> <RAM bytes>". A sketch which     ##
+## does not compile or does not fit on the core is reported with "FAIL" in both size columns.     ##
+## Examples which can't fit on a core are listed as "<fqbn>/<example>" in EXCLUDE and are skipped ##
+## there, they are not reported at all.                                                           ##
+##                                                                                                ##
+## Version Date       Developer      Comments                                                     ##
+## ======= ========== ============== ============================================================ ##
+## 1.0.1   2026-10-19 SV-Zanshin     Added EXCLUDE list for examples which can't fit on a core    ##
+## 1.0.0   2026-10-19 SV-Zanshin     Initial coding                                               ##
+##                                                                                                ##
+####################################################################################################
+set -uo pipefail
+LIBRARY=$(cd "${1:-.}" && pwd)
+OUTPUT=${2:-/dev/stdout}
+FQBNS=${FQBNS:-"ATTinyCore:avr:attinyx5:chip=85 arduino:avr:uno arduino:samd:mkrzero esp32:esp32:esp32"}
+EXCLUDE=${EXCLUDE:-"ATTinyCore:avr:attinyx5:chip=85/AdaptiveDemo ATTinyCore:avr:attinyx5:chip=85/CompensationCheck"}
+for fqbn in ${FQBNS}; do
+  for sketch in "${LIBRARY}"/examples/*/; do
+    name=$(basename "${sketch}")
+    [[ " ${EXCLUDE} " == *" ${fqbn}/${name} "* ]] && continue
+    if json=$(arduino-cli compile --fqbn "${fqbn}" --library "${LIBRARY}" --format json \
+              "${sketch}" 2>/dev/null); then
+      sizes=$(jq -r '[.. | .executable_sections_size? // empty | .[]] |
+                     "\(map(select(.name == "text"))[0].size) \(map(select(.name == "data"))[0].size)"' \
+              <<<"${json}")
+      echo "${fqbn} ${name} ${sizes}"
+    else
+      echo "${fqbn} ${name} FAIL FAIL"
+    fi
+  done
+done >"${OUTPUT}"
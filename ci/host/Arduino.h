@@ -0,0 +1,41 @@
+/***************************************************************************************************
+** Minimal stand-in for the Arduino core used to build the library and CompensationCheck.h on the **
+** build host. Only what BME280.cpp and the checks use is defined, all pin I/O does nothing.      **
+**                                                                                                **
+** Version Date       Developer      Comments                                                     **
+** ======= ========== ============== ============================================================ **
+** 1.0.1   2026-10-19 SV-Zanshin     Include <string.h> like the Arduino core does                **
+** 1.0.0   2026-10-19 SV-Zanshin     Initial coding                                               **
+***************************************************************************************************/
+#ifndef Arduino_h
+#define Arduino_h
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#define B00000011 0x03
+#define B00000111 0x07
+#define B00001001 0x09
+#define B00011111 0x1F
+#define B11100011 0xE3
+#define B11111100 0xFC
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int  digitalRead(uint8_t) { return 0; }
+inline void pinMode(uint8_t, uint8_t) {}
+inline void delay(unsigned long) {}
+inline unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+#endif
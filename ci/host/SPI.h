@@ -0,0 +1,19 @@
+/***************************************************************************************************
+** Host stand-in for the Arduino "SPI" library, all transfers return 0                            **
+***************************************************************************************************/
+#ifndef SPI_h
+#define SPI_h
+#include "Arduino.h"
+class SPISettings {
+ public:
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+class SPIClass {
+ public:
+  void    begin() {}
+  void    beginTransaction(SPISettings) {}
+  void    endTransaction() {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
+extern SPIClass SPI;
+#endif
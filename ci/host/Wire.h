@@ -0,0 +1,19 @@
+/***************************************************************************************************
+** Host stand-in for the Arduino "Wire" library, no device ever answers                           **
+***************************************************************************************************/
+#ifndef Wire_h
+#define Wire_h
+#include "Arduino.h"
+class TwoWire {
+ public:
+  void    begin() {}
+  void    setClock(uint32_t) {}
+  void    beginTransmission(uint8_t) {}
+  uint8_t endTransmission() { return 2; }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  int     available() { return 0; }
+  int     read() { return -1; }
+  size_t  write(uint8_t) { return 1; }
+};
+extern TwoWire Wire;
+#endif
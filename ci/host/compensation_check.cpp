@@ -0,0 +1,55 @@
+/***************************************************************************************************
+** Host build of the CompensationCheck example. Runs the same sweeps and benchmarks as the        **
+** example program using printf() instead of the serial port and returns a non-zero exit code if  **
+** any result differs from the Bosch reference implementation.                                    **
+**                                                                                                **
+** Usage: compensation_check [sweep step] [benchmark samples]                                     **
+**                                                                                                **
+** Version Date       Developer      Comments                                                     **
+** ======= ========== ============== ============================================================ **
+** 1.0.1   2026-10-19 SV-Zanshin     Calibration decoding is checked as well                      **
+** 1.0.0   2026-10-19 SV-Zanshin     Initial coding                                               **
+***************************************************************************************************/
+#include <stdio.h>
+
+#include "CompensationCheck.h"
+
+TwoWire  Wire;  ///< Stand-in I2C bus needed to link the library
+SPIClass SPI;   ///< Stand-in SPI bus needed to link the library
+
+static uint32_t failures = 0;  ///< Number of sweeps with mismatches
+
+static void showResult(const char *name, const SweepResult &result) {
+  printf("  %-11s: %lu mismatches, maximum error %ld\n", name, (unsigned long)result.mismatches,
+         (long)result.maxError);
+  if (result.mismatches) ++failures;
+}  // of function showResult()
+
+static void showTiming(const char *name, const BenchResult &result) {
+  printf("  %-11s: library %.1fns/sample, reference %.1fns/sample\n", name, result.libraryNs,
+         result.referenceNs);
+}  // of function showTiming()
+
+int main(int argc, char *argv[]) {
+  uint32_t step    = argc > 1 ? strtoul(argv[1], NULL, 0) : 1;
+  uint32_t samples = argc > 2 ? strtoul(argv[2], NULL, 0) : 1UL << 22;  // Many timer ticks
+  if (step == 0 || samples == 0) {
+    fprintf(stderr, "usage: %s [sweep step] [benchmark samples]\n", argv[0]);
+    return (2);
+  }  // of if-then invalid arguments
+  for (uint8_t i = 0; i < CALIBRATION_COUNT; i++) {
+    printf("Calibration set %u\n", i);
+    showResult("Calibration", checkCalibration(CALIBRATIONS[i]));
+    showResult("Temperature", checkTemperature(CALIBRATIONS[i], step));
+    for (uint8_t j = 0; j < T_FINE_COUNT; j++) {
+      printf(" At t_fine %ld\n", (long)T_FINES[j]);
+      showResult("Pressure", checkPressure(CALIBRATIONS[i], T_FINES[j], step));
+      showResult("Humidity", checkHumidity(CALIBRATIONS[i], T_FINES[j], step));
+    }  // of for-next each temperature
+    showTiming("Temperature", benchTemperature(CALIBRATIONS[i], samples));
+    showTiming("Pressure", benchPressure(CALIBRATIONS[i], samples));
+    showTiming("Humidity", benchHumidity(CALIBRATIONS[i], samples));
+  }  // of for-next each calibration set
+  printf("%lu sweeps with mismatches\n", (unsigned long)failures);
+  return (failures ? 1 : 0);
+}  // of function main()
@@ -0,0 +1,121 @@
+/*!
+@file AdaptiveDemo.ino
+
+@section AdaptiveDemo_intro_section Description
+
+Example program for using the Bosch BME280 sensor with the adaptive sampling controller. The sensor
+measures temperature, pressure and humidity and is described at
+https://www.bosch-sensortec.com/bst/products/all_products/bme280. The datasheet is available from
+Bosch at https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME280_DS001-11.pdf
+\n\n
+
+The most recent version of the BME280 library is available at https://github.com/Zanduino/BME280
+and the documentation of the library as well as example programs are described in the project's wiki
+pages located at https://github.com/Zanduino/BME280/wiki. \n\n
+
+This example program initializes the BME280 to use I2C for communications and then hands control of
+the sampling settings to a BME280_Adaptive instance. While the readings are stable the sensor takes
+a single low-power forced measurement once a minute, as soon as the temperature or pressure start
+to change faster than the set thresholds the sensor is switched to normal mode with a high sampling
+rate. Each time the profile changes the measurement cycle time and duty cycle are displayed. \n\n
+
+@section AdaptiveDemolicense GNU General Public License v3.0
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version. This program is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details. You should have
+received a copy of the GNU General Public License along with this program.  If not, see
+<http://www.gnu.org/licenses/>.
+
+@section AdaptiveDemoauthor Author
+
+Written by Arnd <Arnd@Zanduino.Com> at https://www.github.com/SV-Zanshin
+
+@section AdaptiveDemoversions Changelog
+
+Version | Date       | Developer  | Comments
+------- | ---------- | ---------- | ---------------------------------------------
+1.0.1   | 2026-10-19 | SV-Zanshin | Duty cycle is now in parts per million
+1.0.0   | 2026-10-19 | SV-Zanshin | Initial coding
+
+*/
+#include <BME280.h>  // Include the BME280 Sensor library
+/***************************************************************************************************
+** Declare all program constants                                                                  **
+***************************************************************************************************/
+const uint32_t SERIAL_SPEED{115200};  ///< Default baud rate for Serial I/O
+const uint16_t TEMP_RATE{50};         ///< Switch on 0.5 degrees Celsius change per minute
+const uint16_t PRESS_RATE{20};        ///< Switch on 20 Pascal change per minute
+
+/***************************************************************************************************
+** Declare global variables and instantiate classes                                               **
+***************************************************************************************************/
+BME280_Class    BME280;            ///< Create an instance of the BME280 class
+BME280_Adaptive Adaptive(BME280);  ///< Create an adaptive controller for the sensor
+
+void showProfile() {
+  /*!
+   * @brief    Display the currently active profile with its cycle and duty cycle
+   * @return   void
+   */
+  if (Adaptive.profile() == LowPowerProfile)
+    Serial.print(F("- Low power profile, "));
+  else
+    Serial.print(F("- High rate profile, "));
+  Serial.print(F("reading every "));
+  Serial.print(Adaptive.cycleTime());
+  Serial.print(F("ms with a duty cycle of "));
+  Serial.print(Adaptive.dutyCycle() / 10000.0, 4);  // parts per million to percent
+  Serial.println(F("%"));
+}  // of method showProfile()
+
+void setup() {
+  /*!
+   * @brief    Arduino method called once at startup to initialize the system
+   * @details  This is an Arduino IDE method which is called first upon boot or restart. It is only
+   * called one time and then control goes to the main "loop()" method, from which control never
+   * returns
+   * @return   void
+   */
+  Serial.begin(SERIAL_SPEED);
+#ifdef __AVR_ATmega32U4__  // If this is a 32U4 processor, then wait 3 seconds to initialize USB
+  delay(3000);
+#endif
+  Serial.println(F("Starting AdaptiveDemo example program for BME280"));
+  Serial.print(F("- Initializing BME280 sensor\n"));
+  while (!BME280.begin(I2C_STANDARD_MODE))  // Start BME280 using I2C protocol
+  {
+    Serial.println(F("-  Unable to find BME280. Waiting 3 seconds."));
+    delay(3000);
+  }  // of loop until device is located
+  Adaptive.setThresholds(TEMP_RATE, PRESS_RATE);
+  Adaptive.begin();  // Use the default low power and high rate profiles
+  showProfile();
+}  // of method setup()
+
+void loop() {
+  /*!
+   * @brief    Arduino method for the main program loop
+   * @details  This is the main program for the Arduino IDE, it is an infinite loop and keeps on
+   * repeating.
+   * @return   void
+   */
+  static uint8_t lastProfile = LowPowerProfile;           // Profile shown last
+  static int32_t temperature, humidity, pressure;         // Store readings
+  if (!Adaptive.update(temperature, humidity, pressure))  // Only display new readings
+    return;
+  Serial.print(F("Temperature: "));
+  Serial.print(temperature / 100.0);  // Temperature in deci-degrees
+  Serial.print(F("C Humidity: "));
+  Serial.print(humidity / 100.0);  // Humidity in deci-percent
+  Serial.print(F("% Pressure: "));
+  Serial.print(pressure / 100.0);
+  Serial.println(F("hPa"));
+  if (Adaptive.profile() != lastProfile)  // Display profile switches
+  {
+    lastProfile = Adaptive.profile();
+    showProfile();
+  }  // of if-then profile has changed
+}  // of method loop()
@@ -0,0 +1,367 @@
+/*!
+@file CompensationCheck.h
+
+@section CompensationCheckh_intro_section Description
+
+Reference implementation, calibration sets, sweeps and benchmarks used by the CompensationCheck
+example program. Nothing in here uses the sensor or the serial port, so the same file is also
+compiled on the build host by the harness in "ci/host", which runs all of the sweeps in a few
+seconds and is run by the "Compensation" github workflow on every push. This file is included from
+exactly one source file in either build. \n\n
+
+The calibration sets are raw dumps of the calibration registers. Each one is decoded both by the
+library's decodeCalibration() and by the reference decoding of the Bosch sensor API, and the two
+results are compared. Each sweep then compares one of the library's compensate*() functions using
+the library's decoding with the integer reference implementation given in section 4.2.3 of the
+Bosch datasheet using the reference decoding, so that a decoding error also shows up as a mismatch.
+The reference returns pressure as an unsigned Q24.8 value, so raw values far outside of the sensor's
+range which compute to a negative pressure wrap around. Pressures are therefore compared on the 24
+integer bits only.
+
+@section CompensationCheckhversions Changelog
+
+Version | Date       | Developer  | Comments
+------- | ---------- | ---------- | ---------------------------------------------
+1.0.3   | 2026-10-19 | SV-Zanshin | Calibration sets are register dumps, decoding is checked too
+1.0.2   | 2026-10-19 | SV-Zanshin | Benchmark hash is done in 32 bits on 64-bit hosts as well
+1.0.1   | 2026-10-19 | SV-Zanshin | Benchmarks hide the test data from the optimizer
+1.0.0   | 2026-10-19 | SV-Zanshin | Moved out of CompensationCheck.ino so it also builds on the host
+
+*/
+#ifndef CompensationCheck_h
+/*! @brief Define guard code to prevent multiple inclusions */
+#define CompensationCheck_h
+#include <BME280.h>  // Include the BME280 Sensor library
+/***************************************************************************************************
+** Declare all constants and types                                                                **
+***************************************************************************************************/
+const uint32_t MAX_20_BIT{0xFFFFF};                 ///< Largest raw temperature and pressure value
+const uint32_t MAX_16_BIT{0xFFFF};                  ///< Largest raw humidity value
+const int32_t  T_FINES[]{-204800, 128000, 435200};  ///< t_fine at -40, 25 and 85 degrees Celsius
+const uint8_t  T_FINE_COUNT{sizeof(T_FINES) / sizeof(T_FINES[0])};  ///< Number of temperatures
+/*! Calibration register dumps to test. The first holds the example values from the Bosch datasheet,
+    the last has a non-zero H3 and negative H4, H5 and H6 to check the decoding of these values */
+// clang-format off
+const uint8_t CALIBRATIONS[][BME280_CALIBRATION_SIZE]{
+  {0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC, 0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B,  // 0x88-0x93
+   0x27, 0x0B, 0x8C, 0x00, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17,  // 0x94-0x9F
+   0x4B, 0x6E, 0x01, 0x00, 0x13, 0x23, 0x03, 0x1E},                         // 0xA1, 0xE1-0xE7
+  {0x69, 0x6D, 0x36, 0x64, 0x32, 0x00, 0xE9, 0x98, 0x02, 0xD6, 0xD0, 0x0B,
+   0x23, 0x16, 0x88, 0xFF, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17,
+   0x4B, 0x6A, 0x01, 0x00, 0x13, 0x29, 0x03, 0x1E},
+  {0xB7, 0x6C, 0xF8, 0x66, 0x32, 0x00, 0x58, 0x93, 0x67, 0xD6, 0xD0, 0x0B,
+   0xB6, 0x1D, 0xA4, 0xFF, 0xF9, 0xFF, 0xAC, 0x26, 0x0A, 0xD8, 0xBD, 0x10,
+   0x4B, 0x62, 0x01, 0x00, 0x15, 0x04, 0x00, 0x1E},
+  {0x80, 0x6F, 0x26, 0x69, 0x32, 0x00, 0xFE, 0x90, 0x00, 0xD7, 0xD0, 0x0B,
+   0xE2, 0x1A, 0xDE, 0xFF, 0xF9, 0xFF, 0xAC, 0x26, 0x0A, 0xD8, 0xBD, 0x10,
+   0x4B, 0x6C, 0x01, 0x00, 0x12, 0x27, 0x03, 0x1E},
+  {0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC, 0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B,
+   0x27, 0x0B, 0x8C, 0x00, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17,
+   0x4B, 0x6E, 0x01, 0x0C, 0xFF, 0xED, 0xFC, 0xE2}};
+// clang-format on
+const uint8_t CALIBRATION_COUNT{sizeof(CALIBRATIONS) / sizeof(CALIBRATIONS[0])};  ///< Set count
+
+/*! @brief Result of comparing the library with the reference over one input range */
+struct SweepResult {
+  uint32_t mismatches;  ///< Number of results which differ from the reference
+  int32_t  maxError;    ///< Largest absolute difference found
+};
+/*! @brief Time per sample of the library and reference code */
+struct BenchResult {
+  float libraryNs;    ///< Nanoseconds per sample for the library function
+  float referenceNs;  ///< Nanoseconds per sample for the reference function
+};
+
+/***************************************************************************************************
+** Declare global variables                                                                       **
+***************************************************************************************************/
+volatile int32_t sink;  ///< Keeps the compiler from optimizing the benchmark loops away
+/*! Calibration pointer which the compiler can't see through, used by the benchmarks */
+typedef const BME280_Calibration *volatile HiddenCalibration;
+
+/***************************************************************************************************
+** Bosch reference implementation from the datasheet and the calibration decoding from the Bosch **
+** sensor API, only the calibration names were changed.                                           **
+** The functions are kept out of line like the library functions in BME280.cpp, so that the       **
+** benchmarks compare calls with calls                                                            **
+***************************************************************************************************/
+void referenceCalibration(const uint8_t *registers, BME280_Calibration &cal) {
+  /*!
+   * @brief      Bosch sensor API calibration decoding, adapted to the register dump layout
+   * @param[in]  registers Registers 0x88-0x9F, 0xA1 and 0xE1-0xE7
+   * @param[out] cal       Calibration values
+   */
+  cal.T1             = (uint16_t)(registers[1] << 8 | registers[0]);
+  cal.T2             = (int16_t)(registers[3] << 8 | registers[2]);
+  cal.T3             = (int16_t)(registers[5] << 8 | registers[4]);
+  cal.P1             = (uint16_t)(registers[7] << 8 | registers[6]);
+  cal.P2             = (int16_t)(registers[9] << 8 | registers[8]);
+  cal.P3             = (int16_t)(registers[11] << 8 | registers[10]);
+  cal.P4             = (int16_t)(registers[13] << 8 | registers[12]);
+  cal.P5             = (int16_t)(registers[15] << 8 | registers[14]);
+  cal.P6             = (int16_t)(registers[17] << 8 | registers[16]);
+  cal.P7             = (int16_t)(registers[19] << 8 | registers[18]);
+  cal.P8             = (int16_t)(registers[21] << 8 | registers[20]);
+  cal.P9             = (int16_t)(registers[23] << 8 | registers[22]);
+  cal.H1             = registers[24];
+  cal.H2             = (int16_t)(registers[26] << 8 | registers[25]);
+  cal.H3             = registers[27];
+  int16_t dig_h4_msb = (int16_t)(int8_t)registers[28] * 16;
+  int16_t dig_h4_lsb = (int16_t)(registers[29] & 0x0F);
+  cal.H4             = dig_h4_msb | dig_h4_lsb;
+  int16_t dig_h5_msb = (int16_t)(int8_t)registers[30] * 16;
+  int16_t dig_h5_lsb = (int16_t)(registers[29] >> 4);
+  cal.H5             = dig_h5_msb | dig_h5_lsb;
+  cal.H6             = (int8_t)registers[31];
+}  // of method referenceCalibration()
+
+__attribute__((noinline)) int32_t referenceTemperature(const BME280_Calibration &cal,
+                                                       const int32_t adc_T, int32_t &t_fine) {
+  /*!
+   * @brief      Bosch reference temperature compensation
+   * @param[in]  cal    Calibration values
+   * @param[in]  adc_T  Raw temperature reading
+   * @param[out] t_fine Fine resolution temperature
+   * @return     Temperature in centi-degrees Celsius
+   */
+  int32_t var1, var2;
+  var1 = ((((adc_T >> 3) - ((int32_t)cal.T1 << 1))) * ((int32_t)cal.T2)) >> 11;
+  var2 = (((((adc_T >> 4) - ((int32_t)cal.T1)) * ((adc_T >> 4) - ((int32_t)cal.T1))) >> 12) *
+          ((int32_t)cal.T3)) >>
+         14;
+  t_fine = var1 + var2;
+  return ((t_fine * 5 + 128) >> 8);
+}  // of method referenceTemperature()
+
+__attribute__((noinline)) uint32_t referencePressure(const BME280_Calibration &cal,
+                                                     const int32_t adc_P, const int32_t t_fine) {
+  /*!
+   * @brief     Bosch reference 64-bit pressure compensation
+   * @param[in] cal    Calibration values
+   * @param[in] adc_P  Raw pressure reading
+   * @param[in] t_fine Fine resolution temperature
+   * @return    Pressure in Q24.8 format pascals
+   */
+  int64_t var1, var2, p;
+  var1 = ((int64_t)t_fine) - 128000;
+  var2 = var1 * var1 * (int64_t)cal.P6;
+  var2 = var2 + ((var1 * (int64_t)cal.P5) << 17);
+  var2 = var2 + (((int64_t)cal.P4) << 35);
+  var1 = ((var1 * var1 * (int64_t)cal.P3) >> 8) + ((var1 * (int64_t)cal.P2) << 12);
+  var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)cal.P1) >> 33;
+  if (var1 == 0) return (0);  // avoid exception caused by division by zero
+  p    = 1048576 - adc_P;
+  p    = (((p << 31) - var2) * 3125) / var1;
+  var1 = (((int64_t)cal.P9) * (p >> 13) * (p >> 13)) >> 25;
+  var2 = (((int64_t)cal.P8) * p) >> 19;
+  p    = ((p + var1 + var2) >> 8) + (((int64_t)cal.P7) << 4);
+  return ((uint32_t)p);
+}  // of method referencePressure()
+
+__attribute__((noinline)) uint32_t referenceHumidity(const BME280_Calibration &cal,
+                                                     const int32_t adc_H, const int32_t t_fine) {
+  /*!
+   * @brief     Bosch reference humidity compensation
+   * @param[in] cal    Calibration values
+   * @param[in] adc_H  Raw humidity reading
+   * @param[in] t_fine Fine resolution temperature
+   * @return    Relative humidity in Q22.10 format percent
+   */
+  int32_t v_x1_u32r;
+  v_x1_u32r = (t_fine - ((int32_t)76800));
+  v_x1_u32r = (((((adc_H << 14) - (((int32_t)cal.H4) << 20) - (((int32_t)cal.H5) * v_x1_u32r)) +
+                 ((int32_t)16384)) >>
+                15) *
+               (((((((v_x1_u32r * ((int32_t)cal.H6)) >> 10) *
+                    (((v_x1_u32r * ((int32_t)cal.H3)) >> 11) + ((int32_t)32768))) >>
+                   10) +
+                  ((int32_t)2097152)) *
+                     ((int32_t)cal.H2) +
+                 8192) >>
+                14));
+  v_x1_u32r =
+      (v_x1_u32r - (((((v_x1_u32r >> 15) * (v_x1_u32r >> 15)) >> 7) * ((int32_t)cal.H1)) >> 4));
+  v_x1_u32r = (v_x1_u32r < 0 ? 0 : v_x1_u32r);
+  v_x1_u32r = (v_x1_u32r > 419430400 ? 419430400 : v_x1_u32r);
+  return ((uint32_t)(v_x1_u32r >> 12));
+}  // of method referenceHumidity()
+
+/***************************************************************************************************
+** Verification functions                                                                         **
+***************************************************************************************************/
+SweepResult checkCalibration(const uint8_t *registers) {
+  /*!
+   * @brief     Compare the library's calibration decoding with the reference decoding
+   * @param[in] registers Calibration register dump
+   * @return    Number of values which differ and largest difference
+   */
+  BME280_Calibration cal, ref;
+  SweepResult        result = {0, 0};
+  BME280_Class::decodeCalibration(registers, cal);
+  referenceCalibration(registers, ref);
+  const int32_t decoded[]{cal.T1, cal.T2, cal.T3, cal.P1, cal.P2, cal.P3, cal.P4, cal.P5, cal.P6,
+                          cal.P7, cal.P8, cal.P9, cal.H1, cal.H2, cal.H3, cal.H4, cal.H5, cal.H6};
+  const int32_t expected[]{ref.T1, ref.T2, ref.T3, ref.P1, ref.P2, ref.P3, ref.P4, ref.P5, ref.P6,
+                           ref.P7, ref.P8, ref.P9, ref.H1, ref.H2, ref.H3, ref.H4, ref.H5, ref.H6};
+  for (uint8_t i = 0; i < sizeof(decoded) / sizeof(decoded[0]); i++) {
+    int32_t error = decoded[i] - expected[i];
+    if (error != 0) ++result.mismatches;
+    if (labs(error) > result.maxError) result.maxError = labs(error);
+  }  // of for-next each calibration value
+  return (result);
+}  // of method checkCalibration()
+
+SweepResult checkTemperature(const uint8_t *registers, const uint32_t step) {
+  /*!
+   * @brief     Compare temperature and t_fine over the complete raw input range
+   * @param[in] registers Calibration register dump
+   * @param[in] step      Test every n-th raw value, 1 means exhaustive
+   * @return    Number of mismatches and largest error
+   */
+  BME280_Calibration cal, ref;
+  SweepResult        result = {0, 0};
+  int32_t            tFine, tFineReference, error;
+  BME280_Class::decodeCalibration(registers, cal);
+  referenceCalibration(registers, ref);
+  for (uint32_t adc = 0; adc <= MAX_20_BIT; adc += step) {
+    error = BME280_Class::compensateTemperature(cal, adc, tFine) -
+            referenceTemperature(ref, adc, tFineReference);
+    if (error != 0 || tFine != tFineReference) ++result.mismatches;
+    if (labs(error) > result.maxError) result.maxError = labs(error);
+  }  // of for-next each raw value
+  return (result);
+}  // of method checkTemperature()
+
+SweepResult checkPressure(const uint8_t *registers, const int32_t tFine, const uint32_t step) {
+  /*!
+   * @brief     Compare pressure over the complete raw input range at one temperature
+   * @param[in] registers Calibration register dump
+   * @param[in] tFine     Fine resolution temperature
+   * @param[in] step      Test every n-th raw value, 1 means exhaustive
+   * @return    Number of mismatches and largest error
+   */
+  BME280_Calibration cal, ref;
+  SweepResult        result = {0, 0};
+  int32_t            error;
+  BME280_Class::decodeCalibration(registers, cal);
+  referenceCalibration(registers, ref);
+  for (uint32_t adc = 0; adc <= MAX_20_BIT; adc += step) {
+    error = (uint32_t)BME280_Class::compensatePressure(cal, adc, tFine) -
+            (referencePressure(ref, adc, tFine) >> 8);  // Q24.8 to pascals
+    error = (int32_t)((uint32_t)error << 8) >> 8;       // Only the 24 integer bits are compared
+    if (error != 0) ++result.mismatches;
+    if (labs(error) > result.maxError) result.maxError = labs(error);
+  }  // of for-next each raw value
+  return (result);
+}  // of method checkPressure()
+
+SweepResult checkHumidity(const uint8_t *registers, const int32_t tFine, const uint32_t step) {
+  /*!
+   * @brief     Compare humidity over the complete raw input range at one temperature
+   * @param[in] registers Calibration register dump
+   * @param[in] tFine     Fine resolution temperature
+   * @param[in] step      Test every n-th raw value, 1 means exhaustive
+   * @return    Number of mismatches and largest error
+   */
+  BME280_Calibration cal, ref;
+  SweepResult        result = {0, 0};
+  int32_t            error;
+  BME280_Class::decodeCalibration(registers, cal);
+  referenceCalibration(registers, ref);
+  for (uint32_t adc = 0; adc <= MAX_16_BIT; adc += step) {
+    error = BME280_Class::compensateHumidity(cal, adc, tFine) -
+            (int32_t)(referenceHumidity(ref, adc, tFine) * 100 / 1024);  // Q22.10 to percent*100
+    if (error != 0) ++result.mismatches;
+    if (labs(error) > result.maxError) result.maxError = labs(error);
+  }  // of for-next each raw value
+  return (result);
+}  // of method checkHumidity()
+
+/***************************************************************************************************
+** Benchmark functions. The calibration values and t_fine are read through volatile variables on  **
+** each call, so that the compiler can't fold the constant test data into either implementation,  **
+** and the raw values are scattered over the input range with a multiplicative hash so that any   **
+** number of samples can be used. Use enough samples for the run to take many timer ticks.        **
+***************************************************************************************************/
+inline uint32_t rawValue(const uint32_t sample, const uint8_t bits) {
+  /*!
+   * @brief     Returns a raw reading for a benchmark sample
+   * @param[in] sample Sample number
+   * @param[in] bits   Width of the raw reading, 20 or 16
+   * @return    Raw reading which is scattered over the full input range
+   */
+  return ((uint32_t)(sample * 2654435761UL) >> (32 - bits));  // Knuth's hash, modulo 2^32
+}  // of method rawValue()
+
+BenchResult benchTemperature(const uint8_t *registers, const uint32_t samples) {
+  /*!
+   * @brief     Time the library and reference temperature compensation
+   * @param[in] registers Calibration register dump
+   * @param[in] samples   Number of samples to time
+   * @return    Nanoseconds per sample for both
+   */
+  BME280_Calibration cal;
+  BME280_Class::decodeCalibration(registers, cal);
+  HiddenCalibration calibration = &cal;  // Hidden from the optimizer
+  BenchResult       result;
+  uint32_t          startTime;
+  int32_t           tFine;
+  startTime = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = BME280_Class::compensateTemperature(*calibration, rawValue(i, 20), tFine);
+  result.libraryNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  startTime        = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = referenceTemperature(*calibration, rawValue(i, 20), tFine);
+  result.referenceNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  return (result);
+}  // of method benchTemperature()
+
+BenchResult benchPressure(const uint8_t *registers, const uint32_t samples) {
+  /*!
+   * @brief     Time the library and reference pressure compensation at 25 degrees Celsius
+   * @param[in] registers Calibration register dump
+   * @param[in] samples   Number of samples to time
+   * @return    Nanoseconds per sample for both
+   */
+  BME280_Calibration cal;
+  BME280_Class::decodeCalibration(registers, cal);
+  HiddenCalibration calibration = &cal;        // Hidden from the optimizer
+  volatile int32_t  tFine       = T_FINES[1];  // Hidden from the optimizer
+  BenchResult       result;
+  uint32_t          startTime;
+  startTime = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = BME280_Class::compensatePressure(*calibration, rawValue(i, 20), tFine);
+  result.libraryNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  startTime        = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = referencePressure(*calibration, rawValue(i, 20), tFine);
+  result.referenceNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  return (result);
+}  // of method benchPressure()
+
+BenchResult benchHumidity(const uint8_t *registers, const uint32_t samples) {
+  /*!
+   * @brief     Time the library and reference humidity compensation at 25 degrees Celsius
+   * @param[in] registers Calibration register dump
+   * @param[in] samples   Number of samples to time
+   * @return    Nanoseconds per sample for both
+   */
+  BME280_Calibration cal;
+  BME280_Class::decodeCalibration(registers, cal);
+  HiddenCalibration calibration = &cal;        // Hidden from the optimizer
+  volatile int32_t  tFine       = T_FINES[1];  // Hidden from the optimizer
+  BenchResult       result;
+  uint32_t          startTime;
+  startTime = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = BME280_Class::compensateHumidity(*calibration, rawValue(i, 16), tFine);
+  result.libraryNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  startTime        = micros();
+  for (uint32_t i = 0; i < samples; i++)
+    sink = referenceHumidity(*calibration, rawValue(i, 16), tFine);
+  result.referenceNs = (uint32_t)(micros() - startTime) * 1000.0 / samples;
+  return (result);
+}  // of method benchHumidity()
+#endif
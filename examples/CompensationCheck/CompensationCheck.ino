@@ -0,0 +1,131 @@
+/*!
+@file CompensationCheck.ino
+
+@section CompensationCheck_intro_section Description
+
+Example program which verifies and benchmarks the BME280 library's compensation functions. No
+sensor needs to be attached, the program runs entirely on the microcontroller. The sensor is
+described at https://www.bosch-sensortec.com/bst/products/all_products/bme280 and the datasheet is
+available from Bosch at
+https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME280_DS001-11.pdf \n\n
+
+The most recent version of the BME280 library is available at https://github.com/Zanduino/BME280
+and the documentation of the library as well as example programs are described in the project's wiki
+pages located at https://github.com/Zanduino/BME280/wiki. \n\n
+
+For each of the calibration register dumps defined in CompensationCheck.h the program first
+compares the library's decodeCalibration() with the reference decoding and then runs the library's
+compensateTemperature(), compensatePressure() and compensateHumidity() functions over the complete
+20-bit temperature and pressure and 16-bit humidity raw input ranges and compares every result with
+the integer reference implementation given in section 4.2.3 of the Bosch datasheet. The pressure
+and humidity sweeps are done at -40, 25 and 85 degrees Celsius. The number of mismatches and the
+largest difference found are displayed, followed by the time per sample in nanoseconds for both the
+library and the reference code. Any change to the compensation math should show zero mismatches
+here, or a documented and bounded maximum error. \n\n
+
+A complete run does over 30 million 64-bit integer computations and takes hours on 8-bit
+processors, the SWEEP_STEP constant can be increased to only test every n-th raw value for a quick
+check. The same sweeps run on the build host in seconds using "make -C ci/host check", this is
+also done by the "Compensation" github workflow, so this program is mainly useful for the on-target
+timings.
+
+@section CompensationChecklicense GNU General Public License v3.0
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version. This program is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details. You should have
+received a copy of the GNU General Public License along with this program.  If not, see
+<http://www.gnu.org/licenses/>.
+
+@section CompensationCheckauthor Author
+
+Written by Arnd <Arnd@Zanduino.Com> at https://www.github.com/SV-Zanshin
+
+@section CompensationCheckversions Changelog
+
+Version | Date       | Developer  | Comments
+------- | ---------- | ---------- | ---------------------------------------------
+1.0.2   | 2026-10-19 | SV-Zanshin | Calibration sets are register dumps, decoding is checked too
+1.0.1   | 2026-10-19 | SV-Zanshin | Checks moved to CompensationCheck.h to also run on the host
+1.0.0   | 2026-10-19 | SV-Zanshin | Initial coding
+
+*/
+#include "CompensationCheck.h"  // Reference code, calibration sets, sweeps and benchmarks
+/***************************************************************************************************
+** Declare all program constants                                                                  **
+***************************************************************************************************/
+const uint32_t SERIAL_SPEED{115200};  ///< Default baud rate for Serial I/O
+const uint32_t SWEEP_STEP{1};         ///< Test every n-th raw value, 1 means exhaustive
+const uint32_t BENCH_SAMPLES{4096};   ///< Number of samples for each benchmark
+
+void showResult(const __FlashStringHelper *name, const SweepResult &result) {
+  /*!
+   * @brief     Display the result of one sweep
+   * @param[in] name   Name of the sweep
+   * @param[in] result Number of mismatches and largest error
+   * @return    void
+   */
+  Serial.print(F("  "));
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(result.mismatches);
+  Serial.print(F(" mismatches, maximum error "));
+  Serial.println(result.maxError);
+}  // of method showResult()
+
+void showTiming(const __FlashStringHelper *name, const BenchResult &result) {
+  /*!
+   * @brief     Display the time per sample of the library and the reference code
+   * @param[in] name   Name of the benchmark
+   * @param[in] result Nanoseconds per sample for both
+   * @return    void
+   */
+  Serial.print(F("  "));
+  Serial.print(name);
+  Serial.print(F(": library "));
+  Serial.print(result.libraryNs);
+  Serial.print(F("ns/sample, reference "));
+  Serial.print(result.referenceNs);
+  Serial.println(F("ns/sample"));
+}  // of method showTiming()
+
+void setup() {
+  /*!
+   * @brief    Arduino method called once at startup to initialize the system
+   * @details  This is an Arduino IDE method which is called first upon boot or restart. It is only
+   * called one time and then control goes to the main "loop()" method, from which control never
+   * returns. All of the checks are run once from here
+   * @return   void
+   */
+  Serial.begin(SERIAL_SPEED);
+#ifdef __AVR_ATmega32U4__  // If this is a 32U4 processor, then wait 3 seconds to initialize USB
+  delay(3000);
+#endif
+  Serial.println(F("Starting CompensationCheck example program for BME280"));
+  for (uint8_t i = 0; i < CALIBRATION_COUNT; i++) {
+    Serial.print(F("Calibration set "));
+    Serial.println(i);
+    showResult(F("Calibration"), checkCalibration(CALIBRATIONS[i]));
+    showResult(F("Temperature"), checkTemperature(CALIBRATIONS[i], SWEEP_STEP));
+    for (uint8_t j = 0; j < T_FINE_COUNT; j++) {
+      Serial.print(F(" At t_fine "));
+      Serial.println(T_FINES[j]);
+      showResult(F("Pressure"), checkPressure(CALIBRATIONS[i], T_FINES[j], SWEEP_STEP));
+      showResult(F("Humidity"), checkHumidity(CALIBRATIONS[i], T_FINES[j], SWEEP_STEP));
+    }  // of for-next each temperature
+    showTiming(F("Temperature"), benchTemperature(CALIBRATIONS[i], BENCH_SAMPLES));
+    showTiming(F("Pressure"), benchPressure(CALIBRATIONS[i], BENCH_SAMPLES));
+    showTiming(F("Humidity"), benchHumidity(CALIBRATIONS[i], BENCH_SAMPLES));
+  }  // of for-next each calibration set
+  Serial.println(F("Done."));
+}  // of method setup()
+
+void loop() {
+  /*!
+   * @brief    Arduino method for the main program loop
+   * @details  Nothing is done here, all of the checks are run once in setup()
+   * @return   void
+   */
+}  // of method loop()
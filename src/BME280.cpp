@@ -6,6 +6,25 @@
  * See main library header file for details
  */
 #include "BME280.h"
+static uint32_t inactiveMicros(const uint8_t inactiveTimeSetting) {
+  /*!
+   * @brief     converts an inactive time setting into microseconds
+   * @param[in] inactiveTimeSetting Setting as defined in the enumerated type inactiveTimeTypes
+   * @return    inactive time in microseconds
+   */
+  switch (inactiveTimeSetting)  // Set inactive time according to setting
+  {
+    case inactiveHalf: return (500);
+    case inactive63ms: return (62500);
+    case inactive125ms: return (125000);
+    case inactive250ms: return (250000);
+    case inactive500ms: return (500000);
+    case inactive1000ms: return (1000000);
+    case inactive10ms: return (10000);
+    case inactive20ms: return (20000);
+  }            // of switch for inactive time code
+  return (0);  // Unknown settings have no inactive time
+}  // of function inactiveMicros()
 BME280_Class::BME280_Class() {}   ///< Empty & unused class constructor
 BME280_Class::~BME280_Class() {}  ///< Empty & unused class destructor
 bool BME280_Class::begin() {
@@ -29,21 +48,22 @@ bool BME280_Class::begin(const uint32_t i2cSpeed) {
    * @param[in] i2cSpeed I2C speed rate in baud
    * @return  returns "true" when the class initialized correctly
    */
-  Wire.begin();                                            // Start I2C as master device
-  Wire.setClock(i2cSpeed);                                 // Set I2C bus speed
-  for (_I2CAddress = 0; _I2CAddress < 127; _I2CAddress++)  // loop all possible addresses
+  Wire.begin();               // Start I2C as master device
+  Wire.setClock(i2cSpeed);    // Set I2C bus speed
+  _transport = I2CTransport;  // All I/O is now done using I2C
+  for (_bus.i2cAddress = 0; _bus.i2cAddress < 127; _bus.i2cAddress++)  // loop all addresses
   {
-    Wire.beginTransmission(_I2CAddress);  // Check current address for BME280
-    if (Wire.endTransmission() == 0)      // If no error we have a device
+    Wire.beginTransmission(_bus.i2cAddress);  // Check current address for BME280
+    if (Wire.endTransmission() == 0)          // If no error we have a device
     {
       if (readByte(BME280_CHIPID_REG) == BME280_CHIPID)  // check for correct chip id
       {
-        getCalibration();  // get the calibration values
-        return true;
-      }             // of if-then device is really a BME280
-    }               // of if-then we have found a device
-  }                 // of for-next each I2C address loop
-  _I2CAddress = 0;  // Set to 0 to denote no I2C found
+        if (getCalibration()) return true;  // get the calibration values
+        break;                              // device can't be used if they can't be read
+      }                                     // of if-then device is really a BME280
+    }                                       // of if-then we have found a device
+  }                                         // of for-next each I2C address loop
+  _transport = UnknownTransport;            // Denote no I2C device found
   return false;
 }  // of method begin()
 bool BME280_Class::begin(const uint8_t chipSelect)  // Use hardware SPI for comms
@@ -57,16 +77,16 @@ bool BME280_Class::begin(const uint8_t chipSelect)  // Use hardware SPI for comm
    * @param[in] chipSelect Hardware SPI CS chip
    * @return  returns "true" when the class initialized correctly
    */
-  _cs = chipSelect;                                  // Store value for future use
-  digitalWrite(_cs, HIGH);                           // High means ignore master
-  pinMode(_cs, OUTPUT);                              // Make the chip select pin output
+  _transport  = HardwareSPITransport;                // All I/O is now done using hardware SPI
+  _bus.spi.cs = chipSelect;                          // Store value for future use
+  digitalWrite(_bus.spi.cs, HIGH);                   // High means ignore master
+  pinMode(_bus.spi.cs, OUTPUT);                      // Make the chip select pin output
   SPI.begin();                                       // Start hardware SPI
   if (readByte(BME280_CHIPID_REG) == BME280_CHIPID)  // check for correct chip id
   {
-    getCalibration();  // get the calibration values
-    return true;       // return success
-  }                    // of if-then device is really a BME280
-  return false;        // return failure if we get here
+    return getCalibration();  // get the calibration values and return success
+  }                           // of if-then device is really a BME280
+  return false;               // return failure if we get here
 }  // of method begin()
 bool BME280_Class::begin(const uint8_t chipSelect, const uint8_t mosi, const uint8_t miso,
                          const uint8_t sck) {
@@ -82,65 +102,175 @@ bool BME280_Class::begin(const uint8_t chipSelect, const uint8_t mosi, const uin
    * @param[in] sck  System Clock
    * @return  returns "true" when the class initialized correctly
    */
-  _cs   = chipSelect;
-  _mosi = mosi;
-  _miso = miso;
-  _sck  = sck;                                       // Store SPI pins
-  digitalWrite(_cs, HIGH);                           // High means ignore master
-  pinMode(_cs, OUTPUT);                              // Make the chip select pin output
-  pinMode(_sck, OUTPUT);                             // Make system clock pin output
-  pinMode(_mosi, OUTPUT);                            // Make master-out slave-in output
-  pinMode(_miso, INPUT);                             // Make master-in slave-out input
+  _transport    = SoftwareSPITransport;  // All I/O is now done using software SPI
+  _bus.spi.cs   = chipSelect;
+  _bus.spi.mosi = mosi;
+  _bus.spi.miso = miso;
+  _bus.spi.sck  = sck;                               // Store SPI pins
+  digitalWrite(_bus.spi.cs, HIGH);                   // High means ignore master
+  pinMode(_bus.spi.cs, OUTPUT);                      // Make the chip select pin output
+  pinMode(_bus.spi.sck, OUTPUT);                     // Make system clock pin output
+  pinMode(_bus.spi.mosi, OUTPUT);                    // Make master-out slave-in output
+  pinMode(_bus.spi.miso, INPUT);                     // Make master-in slave-out input
   if (readByte(BME280_CHIPID_REG) == BME280_CHIPID)  // check for correct chip id
   {
-    getCalibration();  // get the calibration values
-    return true;
-  }  // of if-then device is really a BME280
+    return getCalibration();  // get the calibration values and return success
+  }                           // of if-then device is really a BME280
   return false;
 }  // of method begin()
-void BME280_Class::getCalibration() {
+bool BME280_Class::getCalibration() {
   /*!
    * @brief     reads the calibration register data into local variables for use in converting
    * readings
+   * @details   The temperature and pressure values are stored contiguously in the device and are
+   * read in one burst, the humidity values are read in a second burst. The register contents are
+   * then converted by decodeCalibration()
+   * @return    "false" if fewer bytes than requested were read, the calibration is unusable then
    */
-  getData(BME280_T1_REG, _cal_dig_T1);
-  getData(BME280_T2_REG, _cal_dig_T2);
-  getData(BME280_T3_REG, _cal_dig_T3);
-  getData(BME280_P1_REG, _cal_dig_P1);
-  getData(BME280_P2_REG, _cal_dig_P2);
-  getData(BME280_P3_REG, _cal_dig_P3);
-  getData(BME280_P4_REG, _cal_dig_P4);
-  getData(BME280_P5_REG, _cal_dig_P5);
-  getData(BME280_P6_REG, _cal_dig_P6);
-  getData(BME280_P7_REG, _cal_dig_P7);
-  getData(BME280_P8_REG, _cal_dig_P8);
-  getData(BME280_P9_REG, _cal_dig_P9);
-  getData(BME280_H1_REG, _cal_dig_H1);
-  getData(BME280_H2_REG, _cal_dig_H2);
-  getData(BME280_H3_REG, _cal_dig_P3);
-  uint8_t tempVar;  // Single-Byte temporary variable
-  getData(BME280_H4_REG, tempVar);
-  _cal_dig_H4 = tempVar << 4;
-  getData(BME280_H4_REG + 1, tempVar);
-  _cal_dig_H4 |= tempVar & 0xF;
-  getData(BME280_H5_REG + 2, tempVar);
-  _cal_dig_H5 = tempVar << 4;
-  getData(BME280_H5_REG, tempVar);
-  _cal_dig_H5 |= tempVar >> 4;
-  getData(BME280_H6_REG, _cal_dig_H6);
-  _cal_dig_H5 = (readByte(BME280_H5_REG + 1) << 4) | (readByte(BME280_H5_REG) >> 4);
-  _cal_dig_H6 = readByte(BME280_H6_REG);
+  const uint8_t sizeTP = BME280_H1_REG - BME280_T1_REG - 1;  // T1 - P9, registers 0x88-0x9F
+  const uint8_t sizeH  = BME280_H6_REG - BME280_H2_REG + 1;  // H2 - H6, registers 0xE1-0xE7
+  uint8_t       registers[BME280_CALIBRATION_SIZE];          // Registers 0x88-0x9F, 0xA1, 0xE1-0xE7
+  if (readBytes(BME280_T1_REG, registers, sizeTP) != sizeTP ||
+      readBytes(BME280_H1_REG, registers + sizeTP, 1) != 1 ||
+      readBytes(BME280_H2_REG, registers + sizeTP + 1, sizeH) != sizeH)
+    return (false);  // return error on a short read
+  decodeCalibration(registers, _cal);
+  return (true);
 }  // of method getCalibration()
+void BME280_Class::decodeCalibration(const uint8_t *registers, BME280_Calibration &cal) {
+  /*!
+   * @brief     converts the calibration register contents into calibration values
+   * @details   T1 through P9 are stored as little-endian 16-bit values in the device and are copied
+   * unchanged, the humidity values are unpacked since H4 and H5 share the nibbles of register 0xE5.
+   * The function is static and doesn't access the device so that the "CompensationCheck" example
+   * program can verify it against register dumps
+   * @param[in]  registers BME280_CALIBRATION_SIZE bytes read from registers 0x88-0x9F, 0xA1 and
+   * 0xE1-0xE7 in that order
+   * @param[out] cal       Calibration values
+   */
+  const uint8_t *humidity = registers + BME280_H1_REG - BME280_T1_REG;  // Registers 0xE1-0xE7
+  memcpy(&cal, registers, BME280_H1_REG - BME280_T1_REG - 1);           // T1 - P9
+  cal.H1 = registers[BME280_H1_REG - BME280_T1_REG - 1];
+  cal.H2 = (int16_t)(humidity[1] << 8 | humidity[0]);
+  cal.H3 = humidity[2];
+  cal.H4 = (int16_t)((int8_t)humidity[3] * 16 | (humidity[4] & 0xF));
+  cal.H5 = (int16_t)((int8_t)humidity[5] * 16 | (humidity[4] >> 4));
+  cal.H6 = (int8_t)humidity[6];
+}  // of method decodeCalibration()
 uint8_t BME280_Class::readByte(const uint8_t addr) {
   /*!
    * @brief     interlude function to the getData() function. Reads 1 byte from the given address
    * @param[in] addr Address to read data from
    * @return    returns byte of data read
    */
-  uint8_t returnValue;         // Storage for returned value
+  uint8_t returnValue = 0;     // Storage for returned value
   getData(addr, returnValue);  // Read just one byte
   return (returnValue);        // Return byte just read
 }  // of method readByte()
+uint8_t BME280_Class::readBytes(const uint8_t addr, uint8_t *buffer, const uint8_t size) {
+  /*!
+   * @brief     Burst read from the I2C or SPI bus, all device reads end up here
+   * @details   I2C reads are split into chunks of BME280_I2C_BURST_SIZE bytes, since the receive
+   * buffer of some Wire implementations, such as the USI based ones on ATtiny, holds only 16 bytes
+   * @param[in] addr Memory address to start reading from
+   * @param[out] buffer Storage for the data read
+   * @param[in] size Number of bytes to read
+   * @return    Number of bytes read, 0 if no device has been found by begin()
+   */
+  if (_transport == UnknownTransport) return (0);  // No device, so nothing to read
+  uint8_t bytesRead = size;                        // Number of bytes read
+  if (_transport == I2CTransport)                  // Use I2C protocol
+  {
+    uint8_t chunk, received;  // Bytes requested and received in each chunk
+    for (bytesRead = 0; bytesRead < size; bytesRead += received) {  // Read in chunks
+      chunk = size - bytesRead;
+      if (chunk > BME280_I2C_BURST_SIZE) chunk = BME280_I2C_BURST_SIZE;
+      Wire.beginTransmission(_bus.i2cAddress);   // Address the I2C device
+      Wire.write(addr + bytesRead);              // Send register address to read
+      Wire.endTransmission();                    // Close transmission
+      Wire.requestFrom(_bus.i2cAddress, chunk);  // Request the data
+      received = Wire.available();               // Use the actual number of bytes
+      for (uint8_t i = 0; i < received; i++) *buffer++ = Wire.read();  // read each byte
+      if (received != chunk) return (bytesRead + received);            // stop on a short read
+    }                                                                  // of for-next each chunk
+  } else if (_transport == HardwareSPITransport)                       // otherwise if hardware SPI
+  {
+    SPI.beginTransaction(SPISettings(SPI_HERTZ, MSBFIRST, SPI_MODE0));  // Start the transaction
+    digitalWrite(_bus.spi.cs, LOW);                                     // Tell BME280 to listen up
+    SPI.transfer(addr | 0x80);                                          // bit 7 is high, so read
+    for (uint8_t i = 0; i < size; i++) *buffer++ = SPI.transfer(0);     // read each byte
+    digitalWrite(_bus.spi.cs, HIGH);                                    // Tell BME280 to stop
+    SPI.endTransaction();                                               // End the transaction
+  } else if (_transport == SoftwareSPITransport)                        // otherwise if software SPI
+  {
+    int8_t  i, j;
+    uint8_t reply;
+    digitalWrite(_bus.spi.cs, LOW);                             // Tell BME280 to listen up
+    for (j = 7; j >= 0; j--) {                                  // First send the address byte
+      digitalWrite(_bus.spi.sck, LOW);                          // set the clock signal
+      digitalWrite(_bus.spi.mosi, ((addr) | 0x80) & (1 << j));  // set the MOSI pin state
+      digitalWrite(_bus.spi.sck, HIGH);                         // reset the clock signal
+    }                                                           // of for-next each bit
+    for (i = 0; i < size; i++) {
+      reply = 0;                // reset our return byte
+      for (j = 7; j >= 0; j--)  // Now read the data at that byte
+      {
+        reply <<= 1;                                 // shift buffer one bit left
+        digitalWrite(_bus.spi.sck, LOW);             // set and reset the clock signal
+        digitalWrite(_bus.spi.sck, HIGH);            // pin to get the next MISO bit
+        if (digitalRead(_bus.spi.miso)) reply |= 1;  // read the MISO bit, add to reply
+      }                                              // of for-next each bit
+      *buffer++ = reply;                             // Add byte just read to return data
+    }                                                // of for-next each byte to be read
+    digitalWrite(_bus.spi.cs, HIGH);                 // Tell BME280 to stop listening
+  }                                                  // of if-then-else transport type
+  return (bytesRead);                                // return the number of bytes read
+}  // of method readBytes()
+uint8_t BME280_Class::writeBytes(const uint8_t addr, const uint8_t *buffer, const uint8_t size) {
+  /*!
+   * @brief     Burst write to the I2C or SPI bus, all device writes end up here
+   * @param[in] addr Memory address to write to
+   * @param[in] buffer Data to write
+   * @param[in] size Number of bytes to write
+   * @return    Number of bytes written, 0 if no device has been found by begin()
+   */
+  if (_transport == UnknownTransport) return (0);  // No device, so nothing to write
+  if (_transport == I2CTransport)                  // Use I2C protocol
+  {
+    Wire.beginTransmission(_bus.i2cAddress);                   // Address the I2C device
+    Wire.write(addr);                                          // Send register address to write
+    for (uint8_t i = 0; i < size; i++) Wire.write(*buffer++);  // write each byte
+    Wire.endTransmission();                                    // Close transmission
+  } else if (_transport == HardwareSPITransport)               // otherwise if hardware SPI
+  {
+    SPI.beginTransaction(SPISettings(SPI_HERTZ, MSBFIRST, SPI_MODE0));  // Start the transaction
+    digitalWrite(_bus.spi.cs, LOW);                                     // Tell BME280 to listen up
+    SPI.transfer(addr & ~0x80);                                         // bit 7 is low, so write
+    for (uint8_t i = 0; i < size; i++) SPI.transfer(*buffer++);         // write each byte
+    digitalWrite(_bus.spi.cs, HIGH);                                    // Tell BME280 to stop
+    SPI.endTransaction();                                               // End the transaction
+  } else if (_transport == SoftwareSPITransport)                        // Otherwise if software SPI
+  {
+    int8_t i, j;
+    for (i = 0; i < size; i++) {
+      digitalWrite(_bus.spi.cs, LOW);                            // Tell BME280 to listen up
+      for (j = 7; j >= 0; j--) {                                 // First send the address byte
+        digitalWrite(_bus.spi.sck, LOW);                         // set the clock signal
+        digitalWrite(_bus.spi.mosi, (addr & ~0x80) & (1 << j));  // set the MOSI pin state
+        digitalWrite(_bus.spi.sck, HIGH);                        // reset the clock signal
+      }                                                          // of for-next each bit
+      for (j = 7; j >= 0; j--)                                   // Now write the data byte
+      {
+        digitalWrite(_bus.spi.sck, LOW);                  // set the clock signal
+        digitalWrite(_bus.spi.mosi, *buffer & (1 << j));  // set the MOSI pin state
+        digitalWrite(_bus.spi.sck, HIGH);                 // reset the clock signal
+      }                                                   // of for-next each bit
+      buffer++;                                           // go to next byte to write
+      digitalWrite(_bus.spi.cs, HIGH);                    // Tell BME280 to stop listening
+    }                                                     // of for-next each byte
+  }                                                       // of if-then-else transport type
+  return (size);                                          // return number of bytes written
+}  // of method writeBytes()
 
 uint8_t BME280_Class::mode(const uint8_t operatingMode) {
   /*!
@@ -213,76 +343,105 @@ uint8_t BME280_Class::getOversampling(const uint8_t sensor, const bool actual) {
   return (returnValue);  // return oversampling bits
 }  // of method getOversampling()
 
-void BME280_Class::readSensors() {
+void BME280_Class::readSensors(int32_t &temp, int32_t &hum, int32_t &press) {
   /*!
    * @brief     reads all 3 sensor values from the registers
-   * @details   Read all 3 in one operation and then proceeds to convert the raw temperature,
-   * pressure and humidity readings into standard metric units in the BME280's documentation but the
-   * math used below was taken from Adafruit's Adafruit_BME280_Library at
-   * https://github.com/adafruit/Adafruit_BME280_Library. I think it can be refactored into more
-   * efficient code at some point in the future, but it does work correctly
+   * @details   Read all 3 in one operation and then converts the raw temperature, pressure and
+   * humidity readings into standard metric units using the compensation functions
+   * @param[out] temp  temperature value from device
+   * @param[out] hum   humidity value from device
+   * @param[out] press pressure value from device
    */
-  uint8_t registerBuffer[8];
-  int64_t i, j, p;
+  uint8_t registers[8];
+  int32_t adcT, adcP, adcH, tFine;
   if ((_mode == ForcedMode || _mode == ForcedMode2) && mode() == SleepMode)
     mode(_mode);  // Force a reading if necessary
   while ((readByte(BME280_STATUS_REG) & B00001001) != 0)
-    ;                                                // wait for measurement to complete
-  getData(BME280_PRESSUREDATA_REG, registerBuffer);  // read all 8 bytes in one go
-                                                     //*******************************//
-                                                     // First compute the temperature //
-                                                     //*******************************//
-  _Temperature = (int32_t)registerBuffer[3] << 12 | (int32_t)registerBuffer[4] << 4 |
-                 (int32_t)registerBuffer[5] >> 4;
-  i = ((((_Temperature >> 3) - ((int32_t)_cal_dig_T1 << 1))) * ((int32_t)_cal_dig_T2)) >> 11;
-  j = (((((_Temperature >> 4) - ((int32_t)_cal_dig_T1)) *
-         ((_Temperature >> 4) - ((int32_t)_cal_dig_T1))) >>
-        12) *
-       ((int32_t)_cal_dig_T3)) >>
+    ;                                           // wait for measurement to complete
+  getData(BME280_PRESSUREDATA_REG, registers);  // read all 8 bytes in one go
+  adcP = (int32_t)registers[0] << 12 | (int32_t)registers[1] << 4 | registers[2] >> 4;
+  adcT = (int32_t)registers[3] << 12 | (int32_t)registers[4] << 4 | registers[5] >> 4;
+  adcH = (int32_t)registers[6] << 8 | (int32_t)registers[7];
+
+  temp  = compensateTemperature(_cal, adcT, tFine);  // Has to be first, it computes tFine
+  press = compensatePressure(_cal, adcP, tFine);
+  hum   = compensateHumidity(_cal, adcH, tFine);
+}  // of method readSensors()
+
+int32_t BME280_Class::compensateTemperature(const BME280_Calibration &cal, const int32_t adcT,
+                                            int32_t &tFine) {
+  /*!
+   * @brief      converts a raw temperature reading into centi-degrees Celsius
+   * @details    The compensation math in this and the following two functions was taken from
+   * Adafruit's Adafruit_BME280_Library at https://github.com/adafruit/Adafruit_BME280_Library. I
+   * think it can be refactored into more efficient code at some point in the future, but it does
+   * work correctly. The functions are static and don't access the device so that the
+   * "CompensationCheck" example program can compare them against the Bosch reference
+   * implementation over the full raw input range before and after any such change
+   * @param[in]  cal   Calibration values
+   * @param[in]  adcT  Raw 20-bit temperature reading
+   * @param[out] tFine Fine resolution temperature, used by the pressure and humidity compensation
+   * @return     Temperature in centi-degrees Celsius
+   */
+  int64_t i, j;
+  i = ((((adcT >> 3) - ((int32_t)cal.T1 << 1))) * ((int32_t)cal.T2)) >> 11;
+  j = (((((adcT >> 4) - ((int32_t)cal.T1)) * ((adcT >> 4) - ((int32_t)cal.T1))) >> 12) *
+       ((int32_t)cal.T3)) >>
       14;
-  _tfine       = i + j;
-  _Temperature = (_tfine * 5 + 128) >> 8;  // In centi-degrees Celsius
-                                           //*******************************//
-                                           // Now compute the pressure      //
-                                           //*******************************//
-  _Pressure = (int32_t)registerBuffer[0] << 12 | (int32_t)registerBuffer[1] << 4 |
-              (int32_t)registerBuffer[2] >> 4;
-  i = ((int64_t)_tfine) - 128000;
-  j = i * i * (int64_t)_cal_dig_P6;
-  j = j + ((i * (int64_t)_cal_dig_P5) << 17);
-  j = j + (((int64_t)_cal_dig_P4) << 35);
-  i = ((i * i * (int64_t)_cal_dig_P3) >> 8) + ((i * (int64_t)_cal_dig_P2) << 12);
-  i = (((((int64_t)1) << 47) + i)) * ((int64_t)_cal_dig_P1) >> 33;
-  if (i == 0)
-    _Pressure = 0;  // avoid division by 0 exception
-  else {
-    p         = 1048576 - _Pressure;
-    p         = (((p << 31) - j) * 3125) / i;
-    i         = (((int64_t)_cal_dig_P9) * (p >> 13) * (p >> 13)) >> 25;
-    j         = (((int64_t)_cal_dig_P8) * p) >> 19;
-    p         = ((p + i + j) >> 8) + (((int64_t)_cal_dig_P7) << 4);
-    _Pressure = p >> 8;  // in pascals
-  }                      // of if pressure would cause error
-                         //**********************************//
-                         // And finally compute the humidity //
-                         //**********************************//
-  _Humidity = (int32_t)registerBuffer[6] << 8 | (int32_t)registerBuffer[7];
-  i         = (_tfine - ((int32_t)76800));
-  i = (((((_Humidity << 14) - (((int32_t)_cal_dig_H4) << 20) - (((int32_t)_cal_dig_H5) * i)) +
-         ((int32_t)16384)) >>
+  tFine = i + j;
+  return ((tFine * 5 + 128) >> 8);  // In centi-degrees Celsius
+}  // of method compensateTemperature()
+
+int32_t BME280_Class::compensatePressure(const BME280_Calibration &cal, const int32_t adcP,
+                                         const int32_t tFine) {
+  /*!
+   * @brief     converts a raw pressure reading into pascals
+   * @param[in] cal   Calibration values
+   * @param[in] adcP  Raw 20-bit pressure reading
+   * @param[in] tFine Fine resolution temperature from compensateTemperature()
+   * @return    Pressure in pascals
+   */
+  int64_t i, j, p;
+  i = ((int64_t)tFine) - 128000;
+  j = i * i * (int64_t)cal.P6;
+  j = j + ((i * (int64_t)cal.P5) << 17);
+  j = j + (((int64_t)cal.P4) << 35);
+  i = ((i * i * (int64_t)cal.P3) >> 8) + ((i * (int64_t)cal.P2) << 12);
+  i = (((((int64_t)1) << 47) + i)) * ((int64_t)cal.P1) >> 33;
+  if (i == 0) return (0);  // avoid division by 0 exception
+  p = 1048576 - adcP;
+  p = (((p << 31) - j) * 3125) / i;
+  i = (((int64_t)cal.P9) * (p >> 13) * (p >> 13)) >> 25;
+  j = (((int64_t)cal.P8) * p) >> 19;
+  p = ((p + i + j) >> 8) + (((int64_t)cal.P7) << 4);
+  return (p >> 8);  // in pascals
+}  // of method compensatePressure()
+
+int32_t BME280_Class::compensateHumidity(const BME280_Calibration &cal, const int32_t adcH,
+                                         const int32_t tFine) {
+  /*!
+   * @brief     converts a raw humidity reading into centi-percent relative humidity
+   * @param[in] cal   Calibration values
+   * @param[in] adcH  Raw 16-bit humidity reading
+   * @param[in] tFine Fine resolution temperature from compensateTemperature()
+   * @return    Relative humidity in percent * 100
+   */
+  int64_t i;
+  i = (tFine - ((int32_t)76800));
+  i = (((((adcH << 14) - (((int32_t)cal.H4) << 20) - (((int32_t)cal.H5) * i)) + ((int32_t)16384)) >>
         15) *
-       (((((((i * ((int32_t)_cal_dig_H6)) >> 10) *
-            (((i * ((int32_t)_cal_dig_H3)) >> 11) + ((int32_t)32768))) >>
+       (((((((i * ((int32_t)cal.H6)) >> 10) *
+            (((i * ((int32_t)cal.H3)) >> 11) + ((int32_t)32768))) >>
            10) +
           ((int32_t)2097152)) *
-             ((int32_t)_cal_dig_H2) +
+             ((int32_t)cal.H2) +
          8192) >>
         14));
-  i = (i - (((((i >> 15) * (i >> 15)) >> 7) * ((int32_t)_cal_dig_H1)) >> 4));
+  i = (i - (((((i >> 15) * (i >> 15)) >> 7) * ((int32_t)cal.H1)) >> 4));
   i = (i < 0) ? 0 : i;
   i = (i > 419430400) ? 419430400 : i;
-  _Humidity = (uint32_t)(i >> 12) * 100 / 1024;  // in percent * 100
-}  // of method readSensors()
+  return ((uint32_t)(i >> 12) * 100 / 1024);  // in percent * 100
+}  // of method compensateHumidity()
 
 uint8_t BME280_Class::iirFilter(const uint8_t iirFilterSetting) {
   /*!
@@ -328,19 +487,8 @@ uint32_t BME280_Class::measurementTime(const uint8_t measureTimeSetting) {
    * @return    measurement cycle time
    */
   uint32_t Time1, Time2;
-  uint32_t returnValue = inactiveTime();  // Get inactive time value
-  switch (returnValue)                    // Set inactive time according to
-  {
-    case inactiveHalf: returnValue = 500; break;
-    case inactive63ms: returnValue = 62500; break;
-    case inactive125ms: returnValue = 125000; break;
-    case inactive250ms: returnValue = 250000; break;
-    case inactive500ms: returnValue = 500000; break;
-    case inactive1000ms: returnValue = 1000000; break;
-    case inactive10ms: returnValue = 10000; break;
-    case inactive20ms: returnValue = 20000; break;
-  }                                          // of switch for inactive time code
-  if (measureTimeSetting != TypicalMeasure)  // Set timing factors for Typ / Max
+  uint32_t returnValue = inactiveMicros(inactiveTime());  // Get inactive time value
+  if (measureTimeSetting != TypicalMeasure)               // Set timing factors for Typ / Max
   {
     returnValue += 1250;
     Time1 = 2300;
@@ -366,10 +514,7 @@ void BME280_Class::getSensorData(int32_t &temp, int32_t &hum, int32_t &press) {
    * @param[out] hum   humidity value from device
    * @param[out] press pressure value from device
    */
-  readSensors();         // Get compensated data from BME280
-  temp  = _Temperature;  // Copy global variable to parameter
-  hum   = _Humidity;
-  press = _Pressure;
+  readSensors(temp, hum, press);  // Get compensated data from BME280
 }  // of method getSensorData()
 
 void BME280_Class::reset() {
@@ -377,10 +522,170 @@ void BME280_Class::reset() {
    * @brief      performs a device reset, as if it were powered down and back up again
    */
   putData(BME280_SOFTRESET_REG, BME280_SOFTWARE_CODE);  // writing code here resets device
-  if (_I2CAddress)
+  if (_transport == I2CTransport)
     begin();  // Start device again if I2C
-  else if (_sck)
-    begin(_cs, _mosi, _miso, _sck);  // Use software serial again
-  else
-    begin(_cs);  // otherwise it must be hardware SPI
+  else if (_transport == SoftwareSPITransport)
+    begin(_bus.spi.cs, _bus.spi.mosi, _bus.spi.miso, _bus.spi.sck);  // Use software SPI again
+  else if (_transport == HardwareSPITransport)
+    begin(_bus.spi.cs);  // otherwise it must be hardware SPI
 }  // of method reset()
+
+/***************************************************************************************************
+** BME280_Adaptive class methods                                                                  **
+***************************************************************************************************/
+BME280_Adaptive::BME280_Adaptive(BME280_Class &sensor) : _sensor(sensor) {
+  /*!
+   * @brief     Class constructor, stores the sensor instance and the default profiles
+   * @param[in] sensor BME280_Class instance which has already been started with begin()
+   */
+  _profiles[LowPowerProfile] = BME280_LOW_POWER_PROFILE;
+  _profiles[HighRateProfile] = BME280_HIGH_RATE_PROFILE;
+}  // of class constructor
+void BME280_Adaptive::begin(const BME280_Profile &lowPower, const BME280_Profile &highRate) {
+  /*!
+   * @brief     Stores the two profiles and starts off in the low power profile
+   * @details   The BME280_Class instance must already have been started using one of its begin()
+   * methods before this is called
+   * @param[in] lowPower Profile used while readings are stable
+   * @param[in] highRate Profile used while readings are changing
+   */
+  _profiles[LowPowerProfile] = lowPower;
+  _profiles[HighRateProfile] = highRate;
+  _haveReading               = false;
+  _calmCount                 = 0;
+  _tempNoise                 = 0;
+  _pressNoise                = 0;
+  _lastTempRate              = 0;
+  _lastPressRate             = 0;
+  applyProfile(LowPowerProfile);
+}  // of method begin()
+void BME280_Adaptive::setThresholds(const uint16_t tempRate, const uint16_t pressRate,
+                                    const uint8_t calmWindows, const uint32_t windowMS) {
+  /*!
+   * @brief     Sets the rates of change which cause a switch to the high rate profile
+   * @details   The rates are measured over a window of "windowMS" milliseconds and compared once
+   * per window. Readings need to change by more than the threshold plus twice the measured noise to
+   * count as a change, and "calmWindows" consecutive windows without change are needed before
+   * going back to the low power profile
+   * @param[in] tempRate    Temperature change in centi-degrees per minute
+   * @param[in] pressRate   Pressure change in pascals per minute
+   * @param[in] calmWindows Number of quiet windows before switching back to low power
+   * @param[in] windowMS    Length of the evaluation window in milliseconds
+   */
+  _tempRate    = tempRate;
+  _pressRate   = pressRate;
+  _calmWindows = calmWindows;
+  _windowMS    = windowMS ? windowMS : 1;  // A window length of zero is not allowed
+}  // of method setThresholds()
+uint8_t BME280_Adaptive::profile() const {
+  /*!
+   * @brief     returns the currently active profile
+   * @return    Profile as defined in the enumerated type profileTypes
+   */
+  return (_profile);
+}  // of method profile()
+bool BME280_Adaptive::profile(const uint8_t profileType) {
+  /*!
+   * @brief     Forces a switch to the given profile
+   * @details   The automatic switching continues with the next evaluation window
+   * @param[in] profileType Profile as defined in the enumerated type profileTypes
+   * @return    "false" if the profile is out of range, otherwise "true"
+   */
+  if (profileType >= UnknownProfile) return (false);  // return error if out of range
+  if (profileType != _profile) applyProfile(profileType);
+  _calmCount = 0;
+  return (true);
+}  // of method profile()
+uint32_t BME280_Adaptive::cycleTime() const {
+  /*!
+   * @brief     returns the time between readings for the active profile
+   * @return    Cycle time in milliseconds
+   */
+  return (_cycleMS);
+}  // of method cycleTime()
+uint32_t BME280_Adaptive::dutyCycle() const {
+  /*!
+   * @brief     returns the portion of time the sensor spends measuring in the active profile
+   * @details   The value is computed from measurementTime() when the profile is applied. Parts per
+   * million are used since the low power profiles measure for only a few milliseconds per minute.
+   * In normal mode the device measures continuously, so the read interval doesn't change the value
+   * @return    Duty cycle in parts per million
+   */
+  return (_dutyCycle);
+}  // of method dutyCycle()
+void BME280_Adaptive::applyProfile(const uint8_t profileType) {
+  /*!
+   * @brief     Writes all of the settings of a profile to the device
+   * @details   The datasheet states that writes to the configuration register might be ignored in
+   * normal mode, so the device is put to sleep first and the new operating mode is only set after
+   * all other settings have been written. The cycle and duty cycle values are also recomputed here
+   * @param[in] profileType Profile as defined in the enumerated type profileTypes
+   */
+  const BME280_Profile &p = _profiles[profileType];
+  _sensor.mode(SleepMode);  // Sleep before touching the settings
+  _sensor.setOversampling(TemperatureSensor, p.tempSampling);
+  _sensor.setOversampling(HumiditySensor, p.humidSampling);
+  _sensor.setOversampling(PressureSensor, p.pressSampling);
+  _sensor.iirFilter(p.iirFilter);
+  _sensor.inactiveTime(p.inactiveTime);
+  uint32_t activeTime = _sensor.measurementTime(MaximumMeasure);  // includes inactive time
+  activeTime -= inactiveMicros(p.inactiveTime);                   // so remove it again
+  uint32_t deviceCycle = activeTime;                              // Forced mode cycle time
+  if (p.mode == NormalMode) deviceCycle += inactiveMicros(p.inactiveTime);  // Normal mode cycle
+  _cycleMS = (deviceCycle + 999) / 1000;                         // round up to milliseconds
+  if (p.readIntervalMS > _cycleMS) _cycleMS = p.readIntervalMS;  // can't read faster than device
+  if (p.mode == NormalMode)  // The device keeps measuring no matter how often it is read
+    _dutyCycle = (uint64_t)activeTime * 1000000 / deviceCycle;
+  else  // In forced mode the device only measures once per reading
+    _dutyCycle = (uint64_t)activeTime * 1000 / _cycleMS;  // microseconds per second are ppm
+  if (_dutyCycle > 1000000) _dutyCycle = 1000000;
+  _sensor.mode(p.mode);  // Only now set the new operating mode
+  _profile = profileType;
+}  // of method applyProfile()
+bool BME280_Adaptive::update(int32_t &temp, int32_t &hum, int32_t &press) {
+  /*!
+   * @brief      Takes a reading when one is due and switches profiles if necessary
+   * @details    Should be called frequently from the main loop. Once per evaluation window the rate
+   * of change of temperature and pressure is computed. A change above the threshold plus the noise
+   * estimate of the previous windows switches to the high rate profile, a number of quiet windows
+   * in a row switches back to low power. Only afterwards is the difference between consecutive
+   * rates smoothed into the noise estimate, so that a real change doesn't raise its own threshold
+   * @param[out] temp  temperature value from device
+   * @param[out] hum   humidity value from device
+   * @param[out] press pressure value from device
+   * @return     "true" if a new reading was taken and the parameters were updated
+   */
+  uint32_t now = millis();
+  if (_haveReading && now - _lastReadMS < _cycleMS) return (false);  // Not due yet
+  _sensor.getSensorData(temp, hum, press);
+  _lastReadMS = now;
+  if (!_haveReading)  // The first reading starts the first window
+  {
+    _haveReading   = true;
+    _windowStartMS = now;
+    _windowTemp    = temp;
+    _windowPress   = press;
+    return (true);
+  }  // of if-then first reading
+  uint32_t elapsed = now - _windowStartMS;
+  if (elapsed < _windowMS) return (true);  // Still within the current window
+  int32_t tempRate  = (int64_t)(temp - _windowTemp) * 60000 / elapsed;    // per minute
+  int32_t pressRate = (int64_t)(press - _windowPress) * 60000 / elapsed;  // per minute
+  _windowStartMS    = now;
+  _windowTemp       = temp;
+  _windowPress      = press;
+  if (labs(tempRate) > (int32_t)_tempRate + 2 * _tempNoise ||
+      labs(pressRate) > (int32_t)_pressRate + 2 * _pressNoise)  // Significant change
+  {
+    _calmCount = 0;
+    if (_profile != HighRateProfile) applyProfile(HighRateProfile);
+  } else if (_profile != LowPowerProfile && ++_calmCount >= _calmWindows) {
+    _calmCount = 0;
+    applyProfile(LowPowerProfile);
+  }  // of if-then-else significant change
+  _tempNoise += (labs(tempRate - _lastTempRate) - _tempNoise) / 4;  // exponential smoothing
+  _pressNoise += (labs(pressRate - _lastPressRate) - _pressNoise) / 4;
+  _lastTempRate  = tempRate;
+  _lastPressRate = pressRate;
+  return (true);
+}  // of method update()
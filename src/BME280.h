@@ -59,6 +59,11 @@
 
  Version| Date       | Developer  | Comments
  ------ | ---------- | ---------- | --------
+ 1.0.10 | 2026-10-19 | SV-Zanshin | I2C reads in chunks of 16 bytes, begin() fails on a short read
+ 1.0.9  | 2026-10-19 | SV-Zanshin | Calibration decoding moved to public static decodeCalibration()
+ 1.0.8  | 2026-10-19 | SV-Zanshin | Compensation math moved to public static functions
+ 1.0.7  | 2026-10-19 | SV-Zanshin | Packed calibration record, transport union and burst I/O
+ 1.0.6  | 2026-10-19 | SV-Zanshin | Added BME280_Adaptive class to switch between sampling profiles
  1.0.5  | 2019-01-31 | wolfbert   | Issue #9 - Corrected IIR mask bits
  1.0.3  | 2019-01-31 | SV-Zanshin | Issue #7 - Corrected documentation to Doxygen style
  1.0.2  | 2018-07-22 | SV-Zanshin | Corrected I2C Datatypes
@@ -90,6 +95,7 @@ const uint32_t I2C_FAST_MODE_PLUS_MODE = 1000000;  ///< Really fast mode
 const uint32_t I2C_HIGH_SPEED_MODE     = 3400000;  ///< Turbo mode
   #endif
 const uint32_t SPI_HERTZ               = 500000;  ///< SPI speed in Hz
+const uint8_t  BME280_I2C_BURST_SIZE   = 16;      ///< Largest I2C read, fits small Wire buffers
 const uint8_t  BME280_CHIPID_REG       = 0xD0;    ///< Chip-Id register
 const uint8_t  BME280_CHIPID           = 0x60;    ///< Hard-coded value 0x60 for BME280
 const uint8_t  BME280_SOFTRESET_REG    = 0xE0;    ///< Reset when 0xB6 is written here
@@ -119,6 +125,7 @@ const uint8_t  BME280_H3_REG           = 0xE3;    ///< calibration data register
 const uint8_t  BME280_H4_REG           = 0xE4;    ///< calibration data register
 const uint8_t  BME280_H5_REG           = 0xE5;    ///< calibration data register
 const uint8_t  BME280_H6_REG           = 0xE7;    ///< calibration data register
+const uint8_t  BME280_CALIBRATION_SIZE = 32;      ///< Bytes in 0x88-0x9F, 0xA1 and 0xE1-0xE7
 
 /*************************************************************************************************
 ** Declare all enumerated types used in the class                                               **
@@ -153,6 +160,50 @@ enum inactiveTimeTypes {
 };
 /*! Measure time type list */
 enum measureTimeTypes { TypicalMeasure, MaximumMeasure, UnknownMeasure };
+/*! Communications transport list */
+enum transportTypes { I2CTransport, HardwareSPITransport, SoftwareSPITransport, UnknownTransport };
+/*! Adaptive controller profile list */
+enum profileTypes { LowPowerProfile, HighRateProfile, UnknownProfile };
+
+/*! @brief Complete set of device settings used by the BME280_Adaptive class */
+struct BME280_Profile {
+  uint8_t  mode;            ///< Either ForcedMode or NormalMode
+  uint8_t  tempSampling;    ///< Temperature oversampling, see oversamplingTypes
+  uint8_t  humidSampling;   ///< Humidity oversampling, see oversamplingTypes
+  uint8_t  pressSampling;   ///< Pressure oversampling, see oversamplingTypes
+  uint8_t  iirFilter;       ///< IIR filter setting, see iirFilterTypes
+  uint8_t  inactiveTime;    ///< Standby time in NormalMode, see inactiveTimeTypes
+  uint32_t readIntervalMS;  ///< Milliseconds between readings, 0 means use the device cycle time
+};
+/*! @brief Calibration values as stored in the device, packed to avoid any padding bytes */
+struct BME280_Calibration {
+  uint16_t T1;  ///< Registers 0x88-0x9F are copied unchanged into T1 through P9
+  int16_t  T2;  ///< Temperature calibration
+  int16_t  T3;  ///< Temperature calibration
+  uint16_t P1;  ///< Pressure calibration
+  int16_t  P2;  ///< Pressure calibration
+  int16_t  P3;  ///< Pressure calibration
+  int16_t  P4;  ///< Pressure calibration
+  int16_t  P5;  ///< Pressure calibration
+  int16_t  P6;  ///< Pressure calibration
+  int16_t  P7;  ///< Pressure calibration
+  int16_t  P8;  ///< Pressure calibration
+  int16_t  P9;  ///< Pressure calibration
+  uint8_t  H1;  ///< Humidity calibration
+  int16_t  H2;  ///< Humidity calibration
+  uint8_t  H3;  ///< Humidity calibration
+  int16_t  H4;  ///< Humidity calibration, 12 bits split over 2 registers
+  int16_t  H5;  ///< Humidity calibration, 12 bits split over 2 registers
+  int8_t   H6;  ///< Humidity calibration
+} __attribute__((packed));
+// clang-format off
+/*! Default low power profile - a single forced measurement once a minute with no filtering */
+const BME280_Profile BME280_LOW_POWER_PROFILE = {ForcedMode, Oversample1,  Oversample1, Oversample1,
+                                                 IIROff,     inactiveHalf, 60000};
+/*! Default high rate profile - continuous measurements with light filtering */
+const BME280_Profile BME280_HIGH_RATE_PROFILE = {NormalMode, Oversample1,  Oversample1, Oversample4,
+                                                 IIR2,       inactive63ms, 0};
+// clang-format on
 
 class BME280_Class {
   /*!
@@ -168,30 +219,39 @@ class BME280_Class {
   bool begin(const uint32_t i2cSpeed);
   bool begin(const uint8_t chipSelect);
   bool begin(const uint8_t chipSelect, const uint8_t mosi, const uint8_t miso, const uint8_t sck);
-  uint8_t  mode(const uint8_t operatingMode = UINT8_MAX);
-  bool     setOversampling(const uint8_t sensor, const uint8_t sampling);
-  uint8_t  getOversampling(const uint8_t sensor, const bool actual = false);
-  uint8_t  iirFilter(const uint8_t iirFilterSetting = UINT8_MAX);
-  uint8_t  inactiveTime(const uint8_t inactiveTimeSetting = UINT8_MAX);
-  uint32_t measurementTime(const uint8_t measureTimeSetting = 1);
-  void     getSensorData(int32_t &temp, int32_t &hum, int32_t &press);
-  void     reset();
+  uint8_t        mode(const uint8_t operatingMode = UINT8_MAX);
+  bool           setOversampling(const uint8_t sensor, const uint8_t sampling);
+  uint8_t        getOversampling(const uint8_t sensor, const bool actual = false);
+  uint8_t        iirFilter(const uint8_t iirFilterSetting = UINT8_MAX);
+  uint8_t        inactiveTime(const uint8_t inactiveTimeSetting = UINT8_MAX);
+  uint32_t       measurementTime(const uint8_t measureTimeSetting = 1);
+  void           getSensorData(int32_t &temp, int32_t &hum, int32_t &press);
+  void           reset();
+  static int32_t compensateTemperature(const BME280_Calibration &cal, const int32_t adcT,
+                                       int32_t &tFine);
+  static int32_t compensatePressure(const BME280_Calibration &cal, const int32_t adcP,
+                                    const int32_t tFine);
+  static int32_t compensateHumidity(const BME280_Calibration &cal, const int32_t adcH,
+                                    const int32_t tFine);
+  static void    decodeCalibration(const uint8_t *registers, BME280_Calibration &cal);
 
  private:
-  uint8_t  readByte(const uint8_t addr);
-  void     readSensors();
-  void     getCalibration();
-  bool     _TransmissionStatus = false;  ///< I2C communications status
-  uint8_t  _I2CAddress         = 0;      ///< Default is no I2C address known
-  uint8_t  _cs, _sck, _mosi, _miso;      ///< Hardware and software SPI pins for SPI
-  uint8_t  _cal_dig_H1, _cal_dig_H3;     ///< Calibration variables
-  int8_t   _cal_dig_H6 = 0;              ///< Calibration variables
-  uint16_t _cal_dig_T1, _cal_dig_P1;     ///< Calibration variables
-  int16_t _cal_dig_T2, _cal_dig_T3, _cal_dig_P2, _cal_dig_P3, _cal_dig_P4, _cal_dig_P5, _cal_dig_P6,
-      _cal_dig_P7, _cal_dig_P8, _cal_dig_P9, _cal_dig_H2, _cal_dig_H4,
-      _cal_dig_H5;                                     ///< Calibration variables
-  uint8_t _mode = UINT8_MAX;                           ///< Last mode set
-  int32_t _tfine, _Temperature, _Pressure, _Humidity;  ///< Sensor global variables
+  uint8_t            readByte(const uint8_t addr);
+  void               readSensors(int32_t &temp, int32_t &hum, int32_t &press);
+  bool               getCalibration();
+  uint8_t            readBytes(const uint8_t addr, uint8_t *buffer, const uint8_t size);
+  uint8_t            writeBytes(const uint8_t addr, const uint8_t *buffer, const uint8_t size);
+  BME280_Calibration _cal;                           ///< Calibration values read from the device
+  uint8_t            _transport = UnknownTransport;  ///< Transport used, see transportTypes
+  uint8_t            _mode      = UINT8_MAX;         ///< Last mode set
+  /*! The transport is chosen at runtime by the begin() overload used, so the union is always as
+      large as the 4 SPI pins, even when I2C is used */
+  union {
+    uint8_t i2cAddress;  ///< I2C address of the device
+    struct {
+      uint8_t cs, sck, mosi, miso;  ///< Hardware and software SPI pins
+    } spi;                          ///< SPI pins, sck is only used for software SPI
+  } _bus;                           ///< Transport-specific state, only one is used at a time
   /*********************************************************************************************
   ** Declare the getData and putData methods as template functions. All device I/O is done    **
   ** through these two functions regardless of whether I2C, hardware SPI or software SPI is   **
@@ -199,12 +259,12 @@ class BME280_Class {
   ** passed in and the functions determine the size of the parameter variable and reads or    **
   ** writes that many bytes. So if a read is called using a character array[10] then 10 bytes **
   ** are read, if called with a int8 then only one byte is read. The return value, if used,   **
-  ** is the number of bytes read or written. This is done by using template function          **
-  ** definitions which need to be defined in this header file rather than in the c++ program  **
-  ** library file.                                                                            **
+  ** is the number of bytes read or written. The templates only determine the size and hand   **
+  ** off to the readBytes() and writeBytes() burst functions, so the transport code exists    **
+  ** only once in the library file no matter how many data types are used.                   **
   *********************************************************************************************/
   template <typename T>
-  uint8_t &getData(const uint8_t addr, T &value) {
+  uint8_t getData(const uint8_t addr, T &value) {
     /*!
      * @brief     Template function for reading from the I2C or SPI bus
      * @details   As a template it supports compile-time data type definitions
@@ -212,59 +272,11 @@ class BME280_Class {
      * @param[in] value Data Type "T" to read
      * @return    Size of data read
      */
-
-    uint8_t *      bytePtr    = (uint8_t *)&value;  // Pointer to structure beginning
-    static uint8_t structSize = sizeof(T);          // Number of bytes in structure
-    if (_I2CAddress)  // If I2C address is non-zero then assume I2C bus
-    {
-      Wire.beginTransmission(_I2CAddress);           // Address the I2C device
-      Wire.write(addr);                              // Send register address to read
-      _TransmissionStatus = Wire.endTransmission();  // Close transmission
-      Wire.requestFrom(_I2CAddress, sizeof(T));      // Request 1 byte of data
-      structSize = Wire.available();                 // Use the actual number of bytes
-      for (uint8_t i = 0; i < structSize; i++)
-        *bytePtr++ = Wire.read();  // loop for each byte to be read
-    } else                         // Otherwise use SPI bus
-    {
-      if (_sck == 0)  // if sck is zero then hardware SPI
-      {
-        SPI.beginTransaction(
-            SPISettings(SPI_HERTZ, MSBFIRST, SPI_MODE0));  // Start the SPI transaction
-        digitalWrite(_cs, LOW);                            // Tell BME280 to listen up
-        SPI.transfer(addr | 0x80);                         // bit 7 is high, so read a byte
-        for (uint8_t i = 0; i < structSize; i++)
-          *bytePtr++ = SPI.transfer(0);  // loop for each byte to be read
-        digitalWrite(_cs, HIGH);         // Tell BME280 to stop listening
-        SPI.endTransaction();            // End the transaction
-      } else                             // otherwise we are using software SPI
-      {
-        int8_t  i, j;
-        uint8_t reply;
-        digitalWrite(_cs, LOW);                             // Tell BME280 to listen up
-        for (j = 7; j >= 0; j--) {                          // First send the address byte
-          digitalWrite(_sck, LOW);                          // set the clock signal
-          digitalWrite(_mosi, ((addr) | 0x80) & (1 << j));  // set the MOSI pin state
-          digitalWrite(_sck, HIGH);                         // reset the clock signal
-        }                                                   // of for-next each bit
-        for (i = 0; i < structSize; i++) {
-          reply = 0;                // reset our return byte
-          for (j = 7; j >= 0; j--)  // Now read the data at that byte
-          {
-            reply <<= 1;                         // shift buffer one bit left
-            digitalWrite(_sck, LOW);             // set and reset the clock signal
-            digitalWrite(_sck, HIGH);            // pin to get the next MISO bit
-            if (digitalRead(_miso)) reply |= 1;  // read the MISO bit, add to reply
-          }                                      // of for-next each bit
-          *bytePtr++ = reply;                    // Add byte just read to return data
-        }                                        // of for-next each byte to be read
-        digitalWrite(_cs, HIGH);                 // Tell BME280 to stop listening
-      }                                          // of  if-then-else we are using hardware SPI
-    }                                            // of if-then-else we are using I2C
-    return (structSize);                         // return the number of bytes read
-  }                                              // of method getData()
+    return (readBytes(addr, (uint8_t *)&value, sizeof(T)));
+  }  // of method getData()
 
   template <typename T>
-  uint8_t &putData(const uint8_t addr, const T &value) {
+  uint8_t putData(const uint8_t addr, const T &value) {
     /*!
      * @brief     Template for writing to the I2C or SPI bus
      * @details   As a template it can support compile-time data type definitions
@@ -272,56 +284,51 @@ class BME280_Class {
      * @param[in] value Data Type "T" to read
      * @return    Size of data written
      */
-    const uint8_t *bytePtr    = (const uint8_t *)&value;  // Pointer to structure beginning
-    static uint8_t structSize = sizeof(T);                // Number of bytes in structure
-    if (_I2CAddress)                                      // Use I2C protocol if address is non-zero
-    {
-      Wire.beginTransmission(_I2CAddress);  // Address the I2C device
-      Wire.write(addr);                     // Send register address to write
-      for (uint8_t i = 0; i < sizeof(T); i++)
-        Wire.write(*bytePtr++);                      // loop for each byte to be written
-      _TransmissionStatus = Wire.endTransmission();  // Close transmission
-    } else {
-      if (_sck == 0)  // if sck is zero then use hardware SPI
-      {
-        SPI.beginTransaction(
-            SPISettings(SPI_HERTZ, MSBFIRST, SPI_MODE0));  // start the SPI transaction
-        digitalWrite(_cs, LOW);                            // Tell BME280 to listen up
-        SPI.transfer(addr & ~0x80);                        // bit 7 is low, so write a byte
-        for (uint8_t i = 0; i < structSize; i++)
-          SPI.transfer(*bytePtr++);  // loop for each byte to be written
-        digitalWrite(_cs, HIGH);     // Tell BME280 to stop listening
-        SPI.endTransaction();        // End the transaction
-      } else                         // Otherwise use software SPI
-      {
-        int8_t  i, j;
-        uint8_t reply;
-        for (i = 0; i < structSize; i++) {
-          reply = 0;                                         // reset our return byte
-          digitalWrite(_cs, LOW);                            // Tell BME280 to listen up
-          for (j = 7; j >= 0; j--) {                         // First send the address byte
-            digitalWrite(_sck, LOW);                         // set the clock signal
-            digitalWrite(_mosi, (addr & ~0x80) & (1 << j));  // set the MOSI pin state
-            digitalWrite(_sck, HIGH);                        // reset the clock signal
-          }                                                  // of for-next each bit
-          for (j = 7; j >= 0; j--)                           // Now read the data at that byte
-          {
-            reply <<= 1;                               // shift buffer one bit left
-            digitalWrite(_sck, LOW);                   // set the clock signal
-            digitalWrite(_mosi, *bytePtr & (1 << j));  // set the MOSI pin state
-            digitalWrite(_sck, HIGH);                  // reset the clock signal
-          }                                            // of for-next each bit
-  #ifdef ESP32
-          static uint8_t dummyVar =
-              *bytePtr++;  // go to next byte to write (dummyVar only required for ESP32)
-  #else
-          *bytePtr++;  // go to next byte to write
-  #endif
-          digitalWrite(_cs, HIGH);  // Tell BME280 to stop listening
-        }                           // of for-next each byte to be read
-      }                             // of  if-then-else we are using hardware SPI
-    }                               // of if-then-else we are using I2C
-    return (structSize);            // return number of bytes written
-  }                                 // of method putData()
-};                                  // of BME280 class definition
+    return (writeBytes(addr, (const uint8_t *)&value, sizeof(T)));
+  }  // of method putData()
+};   // of BME280 class definition
+
+class BME280_Adaptive {
+  /*!
+    @class BME280_Adaptive
+    @brief Adaptive sampling controller for a BME280_Class instance
+    @details Watches the rate of change and the noise of the temperature and pressure readings and
+    switches the sensor between a low power and a high rate profile accordingly. The controller
+    is driven by calling update() from the main loop, it returns true whenever a new reading has
+    been taken.
+  */
+ public:
+  BME280_Adaptive(BME280_Class &sensor);
+  void     begin(const BME280_Profile &lowPower = BME280_LOW_POWER_PROFILE,
+                 const BME280_Profile &highRate = BME280_HIGH_RATE_PROFILE);
+  void     setThresholds(const uint16_t tempRate, const uint16_t pressRate,
+                         const uint8_t calmWindows = 3, const uint32_t windowMS = 10000);
+  bool     update(int32_t &temp, int32_t &hum, int32_t &press);
+  uint8_t  profile() const;
+  bool     profile(const uint8_t profileType);
+  uint32_t cycleTime() const;
+  uint32_t dutyCycle() const;
+
+ private:
+  void           applyProfile(const uint8_t profileType);
+  BME280_Class & _sensor;                          ///< Sensor being controlled
+  BME280_Profile _profiles[UnknownProfile];        ///< Low power and high rate profiles
+  uint8_t        _profile       = UnknownProfile;  ///< Currently active profile
+  uint8_t        _calmWindows   = 3;               ///< Quiet windows before dropping back
+  uint8_t        _calmCount     = 0;               ///< Consecutive quiet windows so far
+  uint16_t       _tempRate      = 25;              ///< Trigger in centi-degrees per minute
+  uint16_t       _pressRate     = 25;              ///< Trigger in pascals per minute
+  uint32_t       _dutyCycle     = 0;               ///< Active time in parts per million
+  uint32_t       _cycleMS       = 1;               ///< Milliseconds between readings
+  uint32_t       _windowMS      = 10000;           ///< Rate evaluation window size
+  uint32_t       _lastReadMS    = 0;               ///< millis() of the last reading
+  uint32_t       _windowStartMS = 0;               ///< millis() at start of window
+  int32_t        _windowTemp    = 0;               ///< Temperature at start of window
+  int32_t        _windowPress   = 0;               ///< Pressure at start of window
+  int32_t        _lastTempRate  = 0;               ///< Previous window temperature rate
+  int32_t        _lastPressRate = 0;               ///< Previous window pressure rate
+  int32_t        _tempNoise     = 0;               ///< Smoothed temperature rate jitter
+  int32_t        _pressNoise    = 0;               ///< Smoothed pressure rate jitter
+  bool           _haveReading   = false;           ///< Set once the first reading is in
+};                                                 // of BME280_Adaptive class definition
 #endif